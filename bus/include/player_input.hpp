@@ -237,9 +237,9 @@ private:
 
     // CAN Signals for Player Input
     MakeSignedCANSignal(int8_t, 0, 8, 1, 0) _playerIdSignal{};          // one byte
-    MakeSignedCANSignal(float, 8, 16, 10, 0) _verticalAxisSignal{};     // two bytes
-    MakeSignedCANSignal(float, 24, 16, 10, 0) _horizontalAxisSignal{};  // two bytes
-    MakeSignedCANSignal(float, 40, 16, 10, 0) _rotationAxisSignal{};    // two bytes
+    MakeSignedCANSignal(float, 8, 16, 0.0001, 0) _verticalAxisSignal{};     // two bytes
+    MakeSignedCANSignal(float, 24, 16, 0.0001, 0) _horizontalAxisSignal{};  // two bytes
+    MakeSignedCANSignal(float, 40, 16, 0.0001, 0) _rotationAxisSignal{};    // two bytes
     MakeUnsignedCANSignal(uint8_t, 56, 8, 1, 0) _buttonBitmaskSignal{}; // one byte
 
     // CAN message for Player Input
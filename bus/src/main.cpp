@@ -7,9 +7,9 @@
 // Expected CAN message format
 // message_type 0 : controller input (from controller to game)
 //   signal 0 : player_id (int8_t)
-//   signal 1 : vertical axis (float -1.0 to 1.0)
-//   signal 2 : horizontal axis (float -1.0 to 1.0)
-//   signal 3 : rotation axis (float -1.0 to 1.0)
+//   signal 1 : vertical axis (float -1.0 to 1.0, sent as int16 scaled by 0.0001)
+//   signal 2 : horizontal axis (float -1.0 to 1.0, sent as int16 scaled by 0.0001)
+//   signal 3 : rotation axis (float -1.0 to 1.0, sent as int16 scaled by 0.0001)
 //   signal 4 : button bitmask (uint8_t)
 //     (in order from least significant bit to most significant bit)
 //     bit 0 : shoot
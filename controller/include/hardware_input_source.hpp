@@ -0,0 +1,60 @@
+#ifndef __HARDWARE_INPUT_SOURCE_H__
+#define __HARDWARE_INPUT_SOURCE_H__
+
+// input source for the sticks and buttons wired to the controller
+
+#include <Arduino.h>
+#include <array>
+
+#include "input_source.hpp"
+
+// reads axes from the ADC and buttons from (active low) GPIO pins
+class HardwareInputSource : public InputSource
+{
+public:
+    static const std::uint8_t NUM_BUTTONS = 4;
+
+    HardwareInputSource(std::array<int, NUM_AXES> axisPins, std::array<int, NUM_BUTTONS> buttonPins) : _axisPins(axisPins), _buttonPins(buttonPins) {}
+
+    void initialize() override
+    {
+        for (int pin : _axisPins)
+        {
+            pinMode(pin, INPUT);
+        }
+        for (int pin : _buttonPins)
+        {
+            pinMode(pin, INPUT_PULLUP);
+        }
+        analogReadResolution(_ADC_BITS);
+    }
+
+    float readAxis(AXIS axis) override
+    {
+        // map the 12 bit reading around the center of the stick to -1.0 to 1.0
+        float value = ((float)analogRead(_axisPins[axis]) - _ADC_CENTER) / _ADC_CENTER;
+        return constrain(value, -1.0f, 1.0f);
+    }
+
+    std::uint8_t readButtons() override
+    {
+        std::uint8_t bitmask = 0;
+        for (std::uint8_t i = 0; i < NUM_BUTTONS; i++)
+        {
+            if (digitalRead(_buttonPins[i]) == LOW)
+            {
+                bitmask |= (1 << i);
+            }
+        }
+        return bitmask;
+    }
+
+private:
+    static const std::uint8_t _ADC_BITS = 12;
+    static constexpr float _ADC_CENTER = 2048.0f;
+
+    std::array<int, NUM_AXES> _axisPins;
+    std::array<int, NUM_BUTTONS> _buttonPins;
+};
+
+#endif // __HARDWARE_INPUT_SOURCE_H__
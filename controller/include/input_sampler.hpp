@@ -0,0 +1,160 @@
+#ifndef __INPUT_SAMPLER_H__
+#define __INPUT_SAMPLER_H__
+
+// samples an input source at a high rate, filters the axes, and decides when the input is worth sending
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "input_source.hpp"
+
+struct InputSample
+{
+    std::array<float, InputSource::NUM_AXES> axes{0};
+    std::uint8_t buttons = 0;
+};
+
+class InputSampler
+{
+public:
+    InputSampler(std::shared_ptr<InputSource> inputSource, std::function<void(const InputSample &)> onSend) : _inputSource(inputSource), _onSend(onSend)
+    {
+        // start a full lockout in the past, times are unsigned so this wraps to just before 0
+        _buttonEdgeTimes.fill(0UL - _BUTTON_LOCKOUT);
+    }
+
+    void initialize()
+    {
+        _inputSource->initialize();
+        reset();
+    }
+
+    // forget the filter state and the last sent input, so the next tick sends immediately
+    void reset()
+    {
+        _hasFiltered = false;
+        _hasSent = false;
+    }
+
+    // should be called every SAMPLE_INTERVAL ms, with the current time in ms
+    void tick(unsigned long currentTime)
+    {
+        _inputSource->update(currentTime);
+        InputSample sample = readSample(currentTime);
+
+        if (shouldSend(sample, currentTime))
+        {
+            _lastSent = sample;
+            _lastSendTime = currentTime;
+            _hasSent = true;
+            _onSend(sample);
+        }
+    }
+
+    static const unsigned long SAMPLE_INTERVAL = 2U;
+
+private:
+    static const std::uint8_t _OVERSAMPLE_COUNT = 8;           // raw reads averaged per tick
+    static constexpr float _FILTER_ALPHA = 0.5f;               // weight of the newest averaged reading
+    static constexpr float _AXIS_THRESHOLD = 0.05f;            // axis movement that triggers a send
+    static const unsigned long _MIN_AXIS_SEND_INTERVAL = 10U;  // rate limit for axis-triggered sends
+    static const unsigned long _HEARTBEAT_INTERVAL = 250U;     // must stay under the bus inactivity timeout
+    static const unsigned long _BUTTON_LOCKOUT = 20U;          // ignore further edges on a button while it bounces
+
+    std::shared_ptr<InputSource> _inputSource;
+    std::function<void(const InputSample &)> _onSend;
+
+    InputSample _filtered;
+    bool _hasFiltered = false;
+
+    std::uint8_t _debouncedButtons = 0;
+    std::array<unsigned long, 8> _buttonEdgeTimes; // when each button last changed
+
+    InputSample _lastSent;
+    unsigned long _lastSendTime = 0;
+    bool _hasSent = false;
+
+    InputSample readSample(unsigned long currentTime)
+    {
+        for (int axis = 0; axis < InputSource::NUM_AXES; axis++)
+        {
+            float sum = 0.0f;
+            for (std::uint8_t i = 0; i < _OVERSAMPLE_COUNT; i++)
+            {
+                sum += _inputSource->readAxis((InputSource::AXIS)axis);
+            }
+            float average = sum / _OVERSAMPLE_COUNT;
+
+            if (_hasFiltered)
+            {
+                _filtered.axes[axis] += _FILTER_ALPHA * (average - _filtered.axes[axis]);
+            }
+            else
+            {
+                _filtered.axes[axis] = average;
+            }
+        }
+        _hasFiltered = true;
+
+        _filtered.buttons = debounceButtons(_inputSource->readButtons(), currentTime);
+        return _filtered;
+    }
+
+    // accepts the first edge on a button straight away, then holds it for _BUTTON_LOCKOUT
+    // so that contact bounce does not show up as repeated presses
+    std::uint8_t debounceButtons(std::uint8_t rawButtons, unsigned long currentTime)
+    {
+        for (std::uint8_t i = 0; i < 8; i++)
+        {
+            std::uint8_t bit = 1 << i;
+            if ((rawButtons & bit) == (_debouncedButtons & bit))
+            {
+                continue;
+            }
+
+            if (currentTime - _buttonEdgeTimes[i] < _BUTTON_LOCKOUT)
+            {
+                continue;
+            }
+
+            _debouncedButtons ^= bit;
+            _buttonEdgeTimes[i] = currentTime;
+        }
+        return _debouncedButtons;
+    }
+
+    bool shouldSend(const InputSample &sample, unsigned long currentTime) const
+    {
+        if (!_hasSent)
+        {
+            return true;
+        }
+
+        unsigned long timeSinceLastSend = currentTime - _lastSendTime;
+
+        // any button edge
+        if (sample.buttons != _lastSent.buttons)
+        {
+            return true;
+        }
+
+        if (timeSinceLastSend >= _MIN_AXIS_SEND_INTERVAL)
+        {
+            for (int axis = 0; axis < InputSource::NUM_AXES; axis++)
+            {
+                if (std::fabs(sample.axes[axis] - _lastSent.axes[axis]) >= _AXIS_THRESHOLD)
+                {
+                    return true;
+                }
+            }
+        }
+
+        // nothing changed, keep the connection alive
+        return timeSinceLastSend >= _HEARTBEAT_INTERVAL;
+    }
+};
+
+#endif // __INPUT_SAMPLER_H__
@@ -0,0 +1,100 @@
+#ifndef __INPUT_SOURCE_H__
+#define __INPUT_SOURCE_H__
+
+// pluggable sources of raw controller input, see hardware_input_source.hpp for the pins on the controller
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class InputSource
+{
+public:
+    enum AXIS
+    {
+        VERTICAL,
+        HORIZONTAL,
+        ROTATION,
+        NUM_AXES
+    };
+
+    virtual ~InputSource() = default;
+
+    virtual void initialize() {}
+
+    // called with the current time in ms before each round of reads
+    virtual void update(unsigned long /*currentTime*/) {}
+
+    // returns the raw axis value, in the range -1.0 to 1.0
+    virtual float readAxis(AXIS axis) = 0;
+
+    // returns the button bitmask, lsb is shoot, followed by mine, select, back
+    virtual std::uint8_t readButtons() = 0;
+};
+
+// plays back a looping list of keyframes, for driving the controller without hardware
+class ScriptedInputSource : public InputSource
+{
+public:
+    struct Keyframe
+    {
+        unsigned long timeMs; // time since the start of the script
+        std::array<float, NUM_AXES> axes;
+        std::uint8_t buttons;
+    };
+
+    ScriptedInputSource(std::vector<Keyframe> keyframes, unsigned long lengthMs) : _keyframes(keyframes), _lengthMs(lengthMs) {}
+
+    void update(unsigned long currentTime) override
+    {
+        // the script starts from the first update it sees
+        if (!_started)
+        {
+            _startTime = currentTime;
+            _started = true;
+        }
+        _currentTime = currentTime;
+    }
+
+    float readAxis(AXIS axis) override
+    {
+        const Keyframe *keyframe = currentKeyframe();
+        return keyframe == nullptr ? 0.0f : keyframe->axes[axis];
+    }
+
+    std::uint8_t readButtons() override
+    {
+        const Keyframe *keyframe = currentKeyframe();
+        return keyframe == nullptr ? 0 : keyframe->buttons;
+    }
+
+private:
+    std::vector<Keyframe> _keyframes; // sorted by time
+    unsigned long _lengthMs;
+    unsigned long _startTime = 0;
+    unsigned long _currentTime = 0;
+    bool _started = false;
+
+    // the last keyframe that has started, the script holds its values until the next one
+    const Keyframe *currentKeyframe() const
+    {
+        if (_keyframes.empty() || _lengthMs == 0)
+        {
+            return nullptr;
+        }
+
+        unsigned long scriptTime = (_currentTime - _startTime) % _lengthMs;
+        const Keyframe *current = &_keyframes.front();
+        for (const Keyframe &keyframe : _keyframes)
+        {
+            if (keyframe.timeMs > scriptTime)
+            {
+                break;
+            }
+            current = &keyframe;
+        }
+        return current;
+    }
+};
+
+#endif // __INPUT_SOURCE_H__
@@ -1,6 +1,30 @@
 #include <Arduino.h>
 #include <CAN.h>
 
+// Set to 1 to read the sticks and buttons wired to the pins below,
+// otherwise the controller plays back a scripted set of inputs
+#define USE_HARDWARE_INPUT 0
+
+#include "input_source.hpp"
+#include "input_sampler.hpp"
+#if USE_HARDWARE_INPUT
+#include "hardware_input_source.hpp"
+#endif
+
+// Set to 1 to log sent inputs over serial, at most once every DEBUG_INPUT_LOG_INTERVAL ms
+// serial is slow enough that logging every send would stall the sampling timer
+#define DEBUG_INPUT_LOG 0
+#define DEBUG_INPUT_LOG_INTERVAL 500
+
+// Pin Definitions
+#define VERTICAL_AXIS_PIN GPIO_NUM_34
+#define HORIZONTAL_AXIS_PIN GPIO_NUM_35
+#define ROTATION_AXIS_PIN GPIO_NUM_32
+#define SHOOT_BUTTON_PIN GPIO_NUM_25
+#define MINE_BUTTON_PIN GPIO_NUM_26
+#define SELECT_BUTTON_PIN GPIO_NUM_27
+#define BACK_BUTTON_PIN GPIO_NUM_14
+
 VirtualTimerGroup g_timerGroup;
 
 #pragma region CAN_Setup
@@ -33,15 +57,16 @@ CANRXMessage<1> g_connectionResponseMessage{
 };
 
 // Player Input Message
+// not attached to the timer group, it is sent by the input sampler when the input changes
 MakeSignedCANSignal(int8_t, 0, 8, 1, 0) g_playerIdSignal{};           // one byte
-MakeSignedCANSignal(float, 8, 16, 10, 0) g_verticalAxisSignal{};    // two bytes
-MakeSignedCANSignal(float, 24, 16, 10, 0) g_horizontalAxisSignal{}; // two bytes
-MakeSignedCANSignal(float, 40, 16, 10, 0) g_rotationAxisSignal{};   // two bytes
+MakeSignedCANSignal(float, 8, 16, 0.0001, 0) g_verticalAxisSignal{};    // two bytes
+MakeSignedCANSignal(float, 24, 16, 0.0001, 0) g_horizontalAxisSignal{}; // two bytes
+MakeSignedCANSignal(float, 40, 16, 0.0001, 0) g_rotationAxisSignal{};   // two bytes
 MakeUnsignedCANSignal(uint8_t, 56, 8, 1, 0) g_buttonBitmaskSignal{};  // one byte
 CANTXMessage<5> g_playerInputMessage{
     g_canBus,
     CONTROLLER_INPUT_ADDRESS,
-    1, 100, g_timerGroup,
+    8, 100,
     g_playerIdSignal,
     g_verticalAxisSignal,
     g_horizontalAxisSignal,
@@ -67,25 +92,53 @@ int8_t generateDeviceID()
   return (int8_t)random(0, 255);
 }
 
-void getPlayerInputs()
+#pragma region Input
+#if USE_HARDWARE_INPUT
+std::shared_ptr<InputSource> g_inputSource = std::make_shared<HardwareInputSource>(
+    std::array<int, InputSource::NUM_AXES>{VERTICAL_AXIS_PIN, HORIZONTAL_AXIS_PIN, ROTATION_AXIS_PIN},
+    std::array<int, HardwareInputSource::NUM_BUTTONS>{SHOOT_BUTTON_PIN, MINE_BUTTON_PIN, SELECT_BUTTON_PIN, BACK_BUTTON_PIN});
+#else
+// drive forward, turn while shooting, then sit idle
+std::shared_ptr<InputSource> g_inputSource = std::make_shared<ScriptedInputSource>(
+    std::vector<ScriptedInputSource::Keyframe>{
+        {0, {1.0f, 0.0f, 0.0f}, 0b0000},
+        {1000, {1.0f, 0.0f, 0.5f}, 0b0001},
+        {1500, {1.0f, 0.0f, 0.5f}, 0b0000},
+        {2000, {0.0f, 0.0f, 0.0f}, 0b0000},
+    },
+    5000);
+#endif
+
+void sendPlayerInputs(const InputSample &sample)
 {
   g_playerIdSignal = g_playerId;
-
-  // imagine this is where we would get the player inputs in the hardware
-  // for now we will just send some random inputs
-  g_verticalAxisSignal = random(-100, 100) / 100.0f;
-  g_horizontalAxisSignal = random(-100, 100) / 100.0f;
-  g_rotationAxisSignal = random(-100, 100) / 100.0f;
+  g_verticalAxisSignal = sample.axes[InputSource::VERTICAL];
+  g_horizontalAxisSignal = sample.axes[InputSource::HORIZONTAL];
+  g_rotationAxisSignal = sample.axes[InputSource::ROTATION];
   // lsb is shoot, followed by special action, etc.
-  g_buttonBitmaskSignal = random(0, 255);
+  g_buttonBitmaskSignal = sample.buttons;
+  g_playerInputMessage.EncodeAndSend();
 
-  Serial.printf("Sending player inputs as player %d\n", g_playerId);
-  Serial.printf("Vertical: %f\n", (float)g_verticalAxisSignal);
-  Serial.printf("Horizontal: %f\n", (float)g_horizontalAxisSignal);
-  Serial.printf("Rotation: %f\n", (float)g_rotationAxisSignal);
-  Serial.printf("Button bitmask: %d\n", (int)g_buttonBitmaskSignal);
+#if DEBUG_INPUT_LOG
+  static unsigned long lastLogTime = 0;
+  unsigned long currentTime = millis();
+  if (currentTime - lastLogTime >= DEBUG_INPUT_LOG_INTERVAL)
+  {
+    lastLogTime = currentTime;
+    Serial.printf("Sent player %d inputs: V %f H %f R %f B %d\n",
+                  g_playerId,
+                  (float)g_verticalAxisSignal,
+                  (float)g_horizontalAxisSignal,
+                  (float)g_rotationAxisSignal,
+                  (int)g_buttonBitmaskSignal);
+  }
+#endif
 }
 
+InputSampler g_inputSampler{g_inputSource, sendPlayerInputs};
+
+#pragma endregion
+
 void handleConnectionResponse()
 {
   Serial.println("Connection response received");
@@ -111,6 +164,12 @@ void handleConnectionResponse()
   if (deviceId == g_deviceId)
   {
     g_playerId = playerId;
+    // the connection request keeps going out while connected, so duplicate responses are expected
+    // only reset on the transition, so that the current input is sent straight away when we connect
+    if (g_controllerState != ControllerState::CONNECTED)
+    {
+      g_inputSampler.reset();
+    }
     g_controllerState = ControllerState::CONNECTED;
     Serial.println("Connected");
     // g_connectionRequestMessage.Disable();
@@ -133,19 +192,28 @@ void updateState()
     Serial.println("Awaiting connection response");
     break;
   case ControllerState::CONNECTED:
-    // g_playerInputMessage.Enable();
-    getPlayerInputs();
+    // inputs are sent from sampleInputs
     break;
   }
   g_canBus.Tick();
 }
 
+void sampleInputs()
+{
+  if (g_controllerState == ControllerState::CONNECTED)
+  {
+    g_inputSampler.tick(millis());
+  }
+}
+
 #pragma endregion
 
 void setup()
 {
   g_canBus.Initialize(ICAN::BaudRate::kBaud1M);
   g_timerGroup.AddTimer(100, updateState);
+  g_timerGroup.AddTimer(InputSampler::SAMPLE_INTERVAL, sampleInputs);
+  g_inputSampler.initialize();
 
   // initialize the player id signal to be -1
   g_playerIdSignal = -1;
@@ -156,7 +224,6 @@ void setup()
   Serial.begin(9600);
   Serial.println("Started");
   Serial.println("Setup complete");
-  // g_playerInputMessage.Disable();
 }
 
 void loop() { g_timerGroup.Tick(millis()); }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include <unity.h>
+#include <memory>
+#include <vector>
+
+#include "input_source.hpp"
+#include "input_sampler.hpp"
+
+// input source whose values are set directly by the tests
+class FakeInputSource : public InputSource
+{
+public:
+    std::array<float, NUM_AXES> axes{0};
+    std::uint8_t buttons = 0;
+
+    float readAxis(AXIS axis) override { return axes[axis]; }
+    std::uint8_t readButtons() override { return buttons; }
+};
+
+std::shared_ptr<FakeInputSource> g_source;
+std::shared_ptr<InputSampler> g_sampler;
+std::vector<unsigned long> g_sendTimes;
+unsigned long g_currentTime;
+
+void setUp()
+{
+    g_source = std::make_shared<FakeInputSource>();
+    g_sendTimes.clear();
+    g_currentTime = 0;
+    g_sampler = std::make_shared<InputSampler>(g_source, [](const InputSample &)
+                                               { g_sendTimes.push_back(g_currentTime); });
+    g_sampler->initialize();
+
+    // the first tick always sends
+    g_sampler->tick(g_currentTime);
+    g_sendTimes.clear();
+}
+
+void tearDown() {}
+
+// ticks at the sample rate until the given time, inclusive
+void tickUntil(unsigned long endTime)
+{
+    while (g_currentTime + InputSampler::SAMPLE_INTERVAL <= endTime)
+    {
+        g_currentTime += InputSampler::SAMPLE_INTERVAL;
+        g_sampler->tick(g_currentTime);
+    }
+}
+
+void test_axis_step_sends_within_rate_limit()
+{
+    g_source->axes[InputSource::VERTICAL] = 0.5f;
+    tickUntil(10);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+    TEST_ASSERT_LESS_OR_EQUAL(10, g_sendTimes[0]);
+}
+
+void test_axis_step_after_idle_sends_next_tick()
+{
+    tickUntil(20);
+    TEST_ASSERT_EQUAL(0, g_sendTimes.size());
+    g_source->axes[InputSource::HORIZONTAL] = 0.5f;
+    tickUntil(22);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+    TEST_ASSERT_EQUAL(22, g_sendTimes[0]);
+}
+
+void test_axis_drift_sends_only_on_heartbeat()
+{
+    g_source->axes[InputSource::ROTATION] = 0.01f;
+    tickUntil(248);
+    TEST_ASSERT_EQUAL(0, g_sendTimes.size());
+    tickUntil(250);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+    TEST_ASSERT_EQUAL(250, g_sendTimes[0]);
+}
+
+void test_button_edge_sends_immediately()
+{
+    g_source->buttons = 0b0001;
+    tickUntil(2);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+    TEST_ASSERT_EQUAL(2, g_sendTimes[0]);
+}
+
+void test_button_bounce_is_ignored()
+{
+    g_source->buttons = 0b0001;
+    tickUntil(2);
+    g_source->buttons = 0b0000;
+    tickUntil(4);
+    g_source->buttons = 0b0001;
+    tickUntil(6);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+}
+
+void test_button_release_after_lockout_sends()
+{
+    g_source->buttons = 0b0001;
+    tickUntil(2);
+    g_source->buttons = 0b0000;
+    tickUntil(20);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+    tickUntil(22);
+    TEST_ASSERT_EQUAL(2, g_sendTimes.size());
+    TEST_ASSERT_EQUAL(22, g_sendTimes[1]);
+}
+
+void test_reset_forces_send()
+{
+    tickUntil(2);
+    TEST_ASSERT_EQUAL(0, g_sendTimes.size());
+    g_sampler->reset();
+    tickUntil(4);
+    TEST_ASSERT_EQUAL(1, g_sendTimes.size());
+    TEST_ASSERT_EQUAL(4, g_sendTimes[0]);
+}
+
+void test_scripted_source_holds_and_loops()
+{
+    ScriptedInputSource source{
+        {
+            {0, {0.0f, 0.0f, 0.0f}, 0b0000},
+            {100, {1.0f, 0.0f, 0.0f}, 0b0001},
+        },
+        200};
+
+    source.update(1000);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, source.readAxis(InputSource::VERTICAL));
+    source.update(1150);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, source.readAxis(InputSource::VERTICAL));
+    TEST_ASSERT_EQUAL(0b0001, source.readButtons());
+    source.update(1250);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, source.readAxis(InputSource::VERTICAL));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_axis_step_sends_within_rate_limit);
+    RUN_TEST(test_axis_step_after_idle_sends_next_tick);
+    RUN_TEST(test_axis_drift_sends_only_on_heartbeat);
+    RUN_TEST(test_button_edge_sends_immediately);
+    RUN_TEST(test_button_bounce_is_ignored);
+    RUN_TEST(test_button_release_after_lockout_sends);
+    RUN_TEST(test_reset_forces_send);
+    RUN_TEST(test_scripted_source_holds_and_loops);
+    return UNITY_END();
+}